@@ -0,0 +1,124 @@
+/**
+ * @file acquisition.c
+ * @brief Temperature acquisition front end implementation
+ */
+
+#include "acquisition.h"
+#include "microcontroller.h"
+#include <stddef.h>
+
+/**
+ * @brief Start a bus-wide conversion and note when it began
+ * @param acquisition Acquisition state
+ * @return ds18b20_error_t Error code
+ */
+static ds18b20_error_t start_conversion(acquisition_t *acquisition) {
+    ds18b20_error_t result = ds18b20_start_conversion_all(&acquisition->conversion_time_ms);
+    if (result != DS18B20_OK) {
+        return result;
+    }
+
+    acquisition->conversion_start_ms = get_time_ms();
+    acquisition->conversion_pending = true;
+    return DS18B20_OK;
+}
+
+/**
+ * @brief Read the in-flight conversion from every sensor
+ *
+ * Sleeps until the nominal conversion time has elapsed (usually already
+ * the case in steady state), then reads the whole bus, retrying with a
+ * bounded timeout while any sensor is still converting.
+ *
+ * @param acquisition Acquisition state
+ * @param sweep Readings for every sensor
+ * @return ds18b20_error_t Error code
+ */
+static ds18b20_error_t read_conversion(const acquisition_t *acquisition,
+                                       acquisition_sweep_t *sweep) {
+    uint32_t all = (1u << acquisition->sensor_count) - 1u;
+
+    delay_until_ms(acquisition->conversion_start_ms + acquisition->conversion_time_ms);
+
+    for (;;) {
+        ds18b20_error_t result = ds18b20_read_all(sweep->raw, &sweep->valid_mask, sweep->centi_celsius,
+                                                  acquisition->sensor_count, &sweep->count);
+        if (result != DS18B20_OK) {
+            return result;
+        }
+        sweep->timestamp_ms = get_time_ms();
+
+        if (sweep->valid_mask == all ||
+            get_elapsed_ms(acquisition->conversion_start_ms) >=
+            (uint32_t)acquisition->conversion_time_ms + DS18B20_CONVERSION_TIMEOUT_MARGIN_MS) {
+            return DS18B20_OK;
+        }
+
+        delay_ms(DS18B20_READY_POLL_INTERVAL_MS);
+    }
+}
+
+ds18b20_error_t acquisition_init(acquisition_t *acquisition,
+                                 const ds18b20_handle_t *sensors,
+                                 uint8_t sensor_count,
+                                 acquisition_mode_t mode) {
+    if (acquisition == NULL || sensors == NULL ||
+        sensor_count == 0 || sensor_count > ACQUISITION_MAX_SENSORS) {
+        return DS18B20_ERROR_INVALID_PARAM;
+    }
+
+    acquisition->sensors = sensors;
+    acquisition->sensor_count = sensor_count;
+    acquisition->mode = mode;
+    acquisition->conversion_pending = false;
+    acquisition->conversion_time_ms = DS18B20_CONVERSION_TIME_MS;
+
+    if (mode == ACQUISITION_MODE_PIPELINED) {
+        return start_conversion(acquisition);
+    }
+
+    return DS18B20_OK;
+}
+
+ds18b20_error_t acquisition_collect(acquisition_t *acquisition,
+                                    acquisition_sweep_t *sweep) {
+    if (acquisition == NULL || sweep == NULL) {
+        return DS18B20_ERROR_INVALID_PARAM;
+    }
+
+    if (acquisition->mode == ACQUISITION_MODE_SEQUENTIAL) {
+        sweep->count = acquisition->sensor_count;
+        sweep->valid_mask = 0;
+        sweep->timestamp_ms = get_time_ms();
+        for (uint8_t i = 0; i < acquisition->sensor_count; i++) {
+            ds18b20_temperature_t temperature;
+            if (ds18b20_read_temperature_blocking(&acquisition->sensors[i], &temperature) == DS18B20_OK) {
+                sweep->raw[i] = (int16_t)temperature.raw_value;
+                sweep->centi_celsius[i] = temperature.centi_celsius;
+                sweep->valid_mask |= 1u << i;
+            }
+        }
+        return DS18B20_OK;
+    }
+
+    // Recover from a previous failure by restarting the pipeline
+    ds18b20_error_t result;
+    if (!acquisition->conversion_pending) {
+        result = start_conversion(acquisition);
+        if (result != DS18B20_OK) {
+            return result;
+        }
+    }
+
+    result = read_conversion(acquisition, sweep);
+    acquisition->conversion_pending = false;
+    if (result != DS18B20_OK) {
+        return result;
+    }
+
+    // Kick off the next conversion so it runs while the caller transmits;
+    // a failure here is retried on the next collect
+    start_conversion(acquisition);
+
+    return DS18B20_OK;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file acquisition.h
+ * @brief Temperature acquisition front end
+ *
+ * Samples every scanned DS18B20 on the bus with one of two strategies.
+ * Sequential mode converts and reads each sensor in turn with blocking
+ * calls. Pipelined mode broadcasts one conversion to the whole bus and
+ * keeps it in flight: collecting sweep N immediately starts sweep N+1, so
+ * the sensors convert while the caller encodes and transmits.
+ */
+
+#ifndef ACQUISITION_H
+#define ACQUISITION_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "ds18b20_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum number of sensors sampled per sweep */
+#define ACQUISITION_MAX_SENSORS 8
+
+/**
+ * @brief Acquisition strategy
+ */
+typedef enum {
+    ACQUISITION_MODE_SEQUENTIAL = 0,  /**< Convert, wait and read each sensor in turn */
+    ACQUISITION_MODE_PIPELINED = 1    /**< Bus-wide conversion overlapped with caller work */
+} acquisition_mode_t;
+
+/**
+ * @brief One sweep of readings in structure-of-arrays form
+ *
+ * Entries are indexed in sensor order; only entries whose bit is set in
+ * valid_mask hold a reading from this sweep.
+ */
+typedef struct {
+    int16_t raw[ACQUISITION_MAX_SENSORS];           /**< Raw readings (1/16 °C per LSB) */
+    int16_t centi_celsius[ACQUISITION_MAX_SENSORS]; /**< Readings in 0.01 °C */
+    uint32_t valid_mask;                            /**< Bit i set when entry i is valid */
+    uint8_t count;                                  /**< Number of sensors in the sweep */
+    uint32_t timestamp_ms;                          /**< When the sweep was read */
+} acquisition_sweep_t;
+
+/**
+ * @brief Acquisition state
+ */
+typedef struct {
+    const ds18b20_handle_t *sensors;  /**< Scanned sensor handles */
+    uint8_t sensor_count;             /**< Number of sensors in the sweep */
+    acquisition_mode_t mode;          /**< Acquisition strategy */
+    bool conversion_pending;          /**< A conversion has been started but not read */
+    uint32_t conversion_start_ms;     /**< When the pending conversion was started */
+    uint16_t conversion_time_ms;      /**< Conversion time of the slowest sensor */
+} acquisition_t;
+
+/**
+ * @brief Initialize acquisition for a set of sensors
+ *
+ * In pipelined mode this starts the first bus-wide conversion.
+ *
+ * @param[out] acquisition Acquisition state
+ * @param[in] sensors Sensor handles as returned by ds18b20_scan_devices();
+ *            must outlive the acquisition
+ * @param[in] sensor_count Number of sensors (1 to ACQUISITION_MAX_SENSORS)
+ * @param[in] mode Acquisition strategy
+ * @return ds18b20_error_t Error code
+ */
+ds18b20_error_t acquisition_init(acquisition_t *acquisition,
+                                 const ds18b20_handle_t *sensors,
+                                 uint8_t sensor_count,
+                                 acquisition_mode_t mode);
+
+/**
+ * @brief Collect the next sweep
+ *
+ * Sequential mode performs a full blocking conversion per sensor. Pipelined
+ * mode waits for the bus-wide conversion already in flight (usually
+ * complete by the time the next cycle starts), reads every sensor in one
+ * bulk pass, and starts the next conversion before returning. A sensor
+ * that fails to read is left out of the valid mask.
+ *
+ * @param[in,out] acquisition Acquisition state
+ * @param[out] sweep Readings for every sensor
+ * @return ds18b20_error_t Error code
+ */
+ds18b20_error_t acquisition_collect(acquisition_t *acquisition,
+                                    acquisition_sweep_t *sweep);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ACQUISITION_H */
@@ -0,0 +1,146 @@
+/**
+ * @file adr.c
+ * @brief Adaptive data rate and transmit power control implementation
+ */
+
+#include "adr.h"
+#include <stddef.h>
+
+/**
+ * @brief Start a new observation window
+ * @param adr Controller state
+ * @return radio_error_t Error code
+ */
+static radio_error_t start_window(adr_t *adr) {
+    radio_stats_t stats;
+    radio_error_t result = radio_get_statistics(&stats);
+    if (result != RADIO_OK) {
+        return result;
+    }
+
+    adr->rssi_sum = 0;
+    adr->rssi_count = 0;
+    adr->packets_sent = stats.packets_sent;
+    adr->packets_lost = stats.packets_lost;
+    adr->retries_attempted = stats.retries_attempted;
+    return RADIO_OK;
+}
+
+/**
+ * @brief Check whether this window's transmissions failed too often
+ *
+ * Each retry is a failed attempt, and each lost packet exhausted its
+ * retries; both count against the attempts made.
+ *
+ * @param adr Controller state
+ * @param stats Radio statistics at the end of the window
+ * @return bool True when the failure share reaches the back-off threshold
+ */
+static bool loss_exceeded(const adr_t *adr, const radio_stats_t *stats) {
+    uint32_t retries = stats->retries_attempted - adr->retries_attempted;
+    uint32_t attempts = stats->packets_sent - adr->packets_sent + retries;
+    if (attempts == 0) {
+        return false;
+    }
+
+    uint32_t failures = retries + (stats->packets_lost - adr->packets_lost);
+    return failures * 100 >= attempts * adr->config.loss_backoff_percent;
+}
+
+/**
+ * @brief Pick one step for the window just closed
+ * @param adr Controller state
+ * @param config Radio configuration in effect; updated with the step
+ * @param margin_db Average link margin over the window
+ * @param lossy Failure share reached the back-off threshold
+ * @return bool True when a step was taken
+ */
+static bool choose_step(const adr_t *adr, radio_config_t *config, int margin_db, bool lossy) {
+    if (lossy || margin_db < adr->config.target_margin_db) {
+        if (config->tx_power < RADIO_TX_POWER_MAX) {
+            config->tx_power++;
+            return true;
+        }
+        if (config->data_rate > RADIO_DATA_RATE_1K) {
+            config->data_rate--;
+            return true;
+        }
+        return false;
+    }
+
+    // The margin a step would leave must still clear the hysteresis band,
+    // otherwise the next window would just step back
+    int required_db = adr->config.target_margin_db + adr->config.hysteresis_db;
+
+    if (config->data_rate < RADIO_DATA_RATE_250K) {
+        radio_data_rate_t faster = config->data_rate + 1;
+        int cost_db = radio_get_sensitivity_dbm(faster, config->modulation) -
+                      radio_get_sensitivity_dbm(config->data_rate, config->modulation);
+        if (margin_db - cost_db >= required_db) {
+            config->data_rate = faster;
+            return true;
+        }
+    }
+
+    if (config->tx_power > RADIO_TX_POWER_MIN) {
+        radio_tx_power_t lower = config->tx_power - 1;
+        int cost_db = radio_get_tx_power_dbm(config->tx_power) - radio_get_tx_power_dbm(lower);
+        if (margin_db - cost_db >= required_db) {
+            config->tx_power = lower;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+radio_error_t adr_init(adr_t *adr, const adr_config_t *config) {
+    if (adr == NULL || config == NULL || config->window == 0 ||
+        config->loss_backoff_percent == 0 || config->loss_backoff_percent > 100) {
+        return RADIO_ERROR_INVALID_PARAM;
+    }
+
+    adr->config = *config;
+    return start_window(adr);
+}
+
+radio_error_t adr_update(adr_t *adr, radio_config_t *config, bool *changed) {
+    if (adr == NULL || config == NULL || changed == NULL) {
+        return RADIO_ERROR_INVALID_PARAM;
+    }
+
+    *changed = false;
+
+    int8_t rssi;
+    radio_error_t result = radio_measure_rssi(&rssi);
+    if (result != RADIO_OK) {
+        return result;
+    }
+
+    adr->rssi_sum += rssi;
+    adr->rssi_count++;
+    if (adr->rssi_count < adr->config.window) {
+        return RADIO_OK;
+    }
+
+    radio_stats_t stats;
+    result = radio_get_statistics(&stats);
+    if (result != RADIO_OK) {
+        return result;
+    }
+
+    int margin_db = adr->rssi_sum / adr->rssi_count -
+                    radio_get_sensitivity_dbm(config->data_rate, config->modulation);
+
+    radio_config_t stepped = *config;
+    if (choose_step(adr, &stepped, margin_db, loss_exceeded(adr, &stats))) {
+        result = radio_configure(&stepped);
+        if (result != RADIO_OK) {
+            return result;
+        }
+        *config = stepped;
+        *changed = true;
+    }
+
+    return start_window(adr);
+}
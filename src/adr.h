@@ -0,0 +1,84 @@
+/**
+ * @file adr.h
+ * @brief Adaptive data rate and transmit power control
+ *
+ * Tunes the radio's data rate and transmit power to the link. Over each
+ * observation window the controller averages the RSSI the peer reports
+ * for our frames and counts lost and retried transmissions. The link
+ * margin is that average less the receiver sensitivity at the current
+ * data rate.
+ *
+ * A window with too little margin or too much loss backs off one step:
+ * transmit power goes up first, then the data rate goes down. A window
+ * whose margin would still exceed the target by the hysteresis after a
+ * step moves the other way: the data rate goes up first, then transmit
+ * power goes down. A node close to its gateway thus ends up at the
+ * fastest rate and lowest power its link allows, cutting airtime and
+ * energy per frame. At most one step is taken per window, and each step
+ * starts a fresh window, so the link settles before the next decision.
+ */
+
+#ifndef ADR_H
+#define ADR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "radio_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Controller policy
+ */
+typedef struct {
+    uint8_t target_margin_db;         /**< Link margin to keep above sensitivity */
+    uint8_t hysteresis_db;            /**< Extra margin required before stepping up */
+    uint8_t loss_backoff_percent;     /**< Back off when this share of transmissions fail */
+    uint8_t window;                   /**< RSSI samples per decision (non-zero) */
+} adr_config_t;
+
+/**
+ * @brief Controller state
+ */
+typedef struct {
+    adr_config_t config;              /**< Controller policy */
+    int32_t rssi_sum;                 /**< Sum of RSSI samples in this window */
+    uint8_t rssi_count;               /**< RSSI samples in this window */
+    uint32_t packets_sent;            /**< Packets sent before this window */
+    uint32_t packets_lost;            /**< Packets lost before this window */
+    uint32_t retries_attempted;       /**< Retries attempted before this window */
+} adr_t;
+
+/**
+ * @brief Initialize a controller
+ *
+ * Starts the first window from the radio's current statistics, so the
+ * radio must already be initialized.
+ *
+ * @param[out] adr Controller state
+ * @param[in] config Controller policy
+ * @return radio_error_t Error code
+ */
+radio_error_t adr_init(adr_t *adr, const adr_config_t *config);
+
+/**
+ * @brief Take an RSSI sample and adjust the radio at the end of a window
+ *
+ * Call once per reporting cycle with the radio in RADIO_POWER_IDLE. When
+ * a step is taken it is applied through radio_configure() and written
+ * back to config.
+ *
+ * @param[in,out] adr Controller state
+ * @param[in,out] config Radio configuration in effect
+ * @param[out] changed Set when tx_power or data_rate was changed
+ * @return radio_error_t Error code
+ */
+radio_error_t adr_update(adr_t *adr, radio_config_t *config, bool *changed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADR_H */
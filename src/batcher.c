@@ -0,0 +1,95 @@
+/**
+ * @file batcher.c
+ * @brief Multi-sample report batching implementation
+ */
+
+#include "batcher.h"
+#include <string.h>
+
+payload_error_t batcher_init(batcher_t *batcher, const batcher_config_t *config) {
+    if (batcher == NULL || config == NULL) {
+        return PAYLOAD_ERROR_INVALID_PARAM;
+    }
+
+    if (config->max_samples == 0 || config->max_samples > PAYLOAD_MAX_SAMPLES ||
+        config->max_age_ms > PAYLOAD_MAX_AGE_MS) {
+        return PAYLOAD_ERROR_INVALID_PARAM;
+    }
+
+    memset(batcher, 0, sizeof(*batcher));
+    batcher->config = *config;
+    return PAYLOAD_OK;
+}
+
+payload_error_t batcher_add(batcher_t *batcher,
+                            uint8_t device_id,
+                            int16_t raw,
+                            uint32_t timestamp_ms,
+                            bool priority) {
+    if (batcher == NULL) {
+        return PAYLOAD_ERROR_INVALID_PARAM;
+    }
+
+    if (batcher->count >= batcher->config.max_samples) {
+        return PAYLOAD_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    batcher->samples[batcher->count].device_id = device_id;
+    batcher->samples[batcher->count].raw = raw;
+    batcher->timestamps_ms[batcher->count] = timestamp_ms;
+    batcher->count++;
+    batcher->priority_pending |= priority;
+
+    return PAYLOAD_OK;
+}
+
+bool batcher_should_flush(const batcher_t *batcher, uint32_t now_ms) {
+    if (batcher == NULL || batcher->count == 0) {
+        return false;
+    }
+
+    return batcher->priority_pending ||
+           batcher->count >= batcher->config.max_samples ||
+           now_ms - batcher->timestamps_ms[0] >= batcher->config.max_age_ms;
+}
+
+payload_error_t batcher_flush(batcher_t *batcher, uint32_t now_ms, radio_packet_t *packet) {
+    if (batcher == NULL || packet == NULL || batcher->count == 0) {
+        return PAYLOAD_ERROR_INVALID_PARAM;
+    }
+
+    payload_frame_t frame;
+    frame.sequence = batcher->next_sequence;
+    frame.sample_count = batcher->count;
+    for (uint8_t i = 0; i < batcher->count; i++) {
+        uint32_t age_ms = now_ms - batcher->timestamps_ms[i];
+        frame.samples[i] = batcher->samples[i];
+        frame.samples[i].age_ms = age_ms > PAYLOAD_MAX_AGE_MS ? PAYLOAD_MAX_AGE_MS : (uint16_t)age_ms;
+    }
+
+    size_t payload_size = 0;
+    payload_error_t result = payload_encode(&frame, packet->payload, sizeof(packet->payload), &payload_size);
+    if (result != PAYLOAD_OK) {
+        return result;
+    }
+
+    packet->payload_size = (uint8_t)payload_size;
+    packet->timestamp = now_ms;
+    if (batcher->priority_pending && packet->priority < RADIO_PRIORITY_HIGH) {
+        packet->priority = RADIO_PRIORITY_HIGH;
+    }
+
+    batcher->next_sequence += batcher->count;
+    batcher->count = 0;
+    batcher->priority_pending = false;
+
+    return PAYLOAD_OK;
+}
+
+payload_error_t batcher_stamp(radio_packet_t *packet, uint32_t on_air_ms) {
+    if (packet == NULL) {
+        return PAYLOAD_ERROR_INVALID_PARAM;
+    }
+
+    return payload_add_age(packet->payload, packet->payload_size, on_air_ms - packet->timestamp);
+}
@@ -0,0 +1,112 @@
+/**
+ * @file batcher.h
+ * @brief Multi-sample report batching
+ *
+ * Collects samples from every sensor and packs them into a single payload
+ * frame, so the per-packet radio overhead (preamble, header, ACK
+ * turnaround) and the radio wake-up are paid once per batch instead of
+ * once per reading. A batch is flushed when it reaches the configured
+ * sample count, when its oldest sample reaches the configured age, or as
+ * soon as a priority sample is added.
+ */
+
+#ifndef BATCHER_H
+#define BATCHER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "payload_codec.h"
+#include "radio_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Batching policy
+ */
+typedef struct {
+    uint8_t max_samples;              /**< Flush at this many samples (1 to PAYLOAD_MAX_SAMPLES) */
+    uint32_t max_age_ms;              /**< Flush when the oldest sample is this old (up to PAYLOAD_MAX_AGE_MS) */
+} batcher_config_t;
+
+/**
+ * @brief Batch state
+ */
+typedef struct {
+    batcher_config_t config;          /**< Batching policy */
+    payload_sample_t samples[PAYLOAD_MAX_SAMPLES]; /**< Queued samples (age filled at flush) */
+    uint32_t timestamps_ms[PAYLOAD_MAX_SAMPLES];   /**< Capture time of each queued sample */
+    uint8_t count;                    /**< Number of queued samples */
+    bool priority_pending;            /**< A queued sample requested immediate delivery */
+    uint16_t next_sequence;           /**< Sequence number of the next sample */
+} batcher_t;
+
+/**
+ * @brief Initialize a batcher
+ *
+ * @param[out] batcher Batch state
+ * @param[in] config Batching policy
+ * @return payload_error_t Error code
+ */
+payload_error_t batcher_init(batcher_t *batcher, const batcher_config_t *config);
+
+/**
+ * @brief Queue a sample
+ *
+ * @param[in,out] batcher Batch state
+ * @param[in] device_id Sensor slot
+ * @param[in] raw Raw temperature (1/16 °C per LSB)
+ * @param[in] timestamp_ms Capture time on the get_time_ms() time base
+ * @param[in] priority Deliver the batch as soon as possible
+ * @return payload_error_t PAYLOAD_ERROR_BUFFER_TOO_SMALL if the batch is
+ *         full and must be flushed first
+ */
+payload_error_t batcher_add(batcher_t *batcher,
+                            uint8_t device_id,
+                            int16_t raw,
+                            uint32_t timestamp_ms,
+                            bool priority);
+
+/**
+ * @brief Check whether the batch should be sent now
+ *
+ * @param[in] batcher Batch state
+ * @param[in] now_ms Current time on the get_time_ms() time base
+ * @return bool True on size, age or priority trigger
+ */
+bool batcher_should_flush(const batcher_t *batcher, uint32_t now_ms);
+
+/**
+ * @brief Encode the queued samples into a radio packet and empty the batch
+ *
+ * Sample ages are computed relative to now_ms, which is also left in
+ * the packet's timestamp; batcher_stamp() brings them up to date when the
+ * packet goes on air. The packet priority is raised to
+ * RADIO_PRIORITY_HIGH when a priority sample is included.
+ *
+ * @param[in,out] batcher Batch state
+ * @param[in] now_ms Current time on the get_time_ms() time base
+ * @param[out] packet Packet whose payload, size and priority are set
+ * @return payload_error_t Error code
+ */
+payload_error_t batcher_flush(batcher_t *batcher, uint32_t now_ms, radio_packet_t *packet);
+
+/**
+ * @brief Bring the sample ages of a flushed packet up to its transmission
+ *
+ * Adds the time the packet spent queued behind duty-cycle holds and
+ * channel backoffs, so the gateway's (receive time - age) is the capture
+ * time. Meant to be called from the radio_tx_callback_t.
+ *
+ * @param[in,out] packet Packet from batcher_flush(), timestamp unchanged
+ * @param[in] on_air_ms Transmission start on the get_time_ms() time base
+ * @return payload_error_t Error code
+ */
+payload_error_t batcher_stamp(radio_packet_t *packet, uint32_t on_air_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BATCHER_H */
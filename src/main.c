@@ -4,9 +4,118 @@
 #include "ds18b20_driver.h"
 #include "radio_driver.h"
 #include "microcontroller.h"
+#include "scheduler.h"
+#include "acquisition.h"
+#include "payload_codec.h"
+#include "batcher.h"
+#include "adr.h"
 
 #define GPIO_PIN_1WIRE 15
 
+/** Reporting period; cycles start on an absolute grid of this spacing */
+#define REPORT_PERIOD_MS 1000
+
+/** Overlap each sensor conversion with transmission of the previous sample */
+#define ACQUISITION_MODE ACQUISITION_MODE_PIPELINED
+
+/** Send a batch once its oldest sample is this old */
+#define BATCH_MAX_AGE_MS 10000
+
+/** Link margin the rate/power controller keeps above receiver sensitivity */
+#define ADR_TARGET_MARGIN_DB 10
+
+/** Extra margin required before the controller speeds up or turns down power */
+#define ADR_HYSTERESIS_DB 5
+
+/** Back off when this share of transmission attempts fail */
+#define ADR_LOSS_BACKOFF_PERCENT 20
+
+/** Reporting cycles (RSSI samples) per controller decision */
+#define ADR_WINDOW_CYCLES 16
+
+/** Received packets handed to the application per reporting cycle */
+#define RX_DISPATCH_BUDGET 8
+
+/**
+ * @brief Format a centi-degree reading as a decimal string without floats
+ * @param buffer Output buffer
+ * @param size Size of the output buffer
+ * @param centi_celsius Temperature in hundredths of a degree Celsius
+ */
+static void format_centi_celsius(char *buffer, size_t size, int16_t centi_celsius) {
+    int32_t magnitude = centi_celsius < 0 ? -(int32_t)centi_celsius : centi_celsius;
+    snprintf(buffer, size, "%s%ld.%02ld", centi_celsius < 0 ? "-" : "",
+             (long)(magnitude / 100), (long)(magnitude % 100));
+}
+
+/**
+ * @brief Report the outcome of a queued transmission
+ * @param event Transmission result
+ * @param user_data Unused
+ */
+static void on_radio_event(radio_error_t event, void *user_data) {
+    (void)user_data;
+    
+    if (event == RADIO_OK) {
+        printf("✓ Batch transmitted\n");
+    } else {
+        printf("✗ Radio transmission failed: %s\n", radio_get_error_string(event));
+    }
+}
+
+/**
+ * @brief Report a packet received from the network
+ * @param packet Received packet, valid for the duration of the call
+ * @param user_data Unused
+ */
+static void on_radio_packet(const radio_packet_t *packet, void *user_data) {
+    (void)user_data;
+    
+    printf("Radio packet received: %u bytes\n", (unsigned)packet->payload_size);
+}
+
+/**
+ * @brief Age a batch's samples to the moment it goes on air
+ * @param packet Packet from send_batch(), about to be transmitted
+ * @param on_air_ms Transmission start
+ * @param user_data Unused
+ */
+static void on_radio_transmit(radio_packet_t *packet, uint32_t on_air_ms, void *user_data) {
+    (void)user_data;
+    
+    batcher_stamp(packet, on_air_ms);
+}
+
+/**
+ * @brief Flush the batch into one radio packet and queue it for transmission
+ *
+ * Returns as soon as the packet is queued; the radio's transmit engine
+ * handles acknowledgment and retries while sampling continues, and the
+ * outcome arrives through on_radio_event().
+ *
+ * @param batcher Batch to send
+ */
+static void send_batch(batcher_t *batcher) {
+    radio_packet_t packet = {0};
+    packet.priority = RADIO_PRIORITY_NORMAL;
+    packet.require_ack = true;
+    
+    uint8_t sample_count = batcher->count;
+    if (batcher_flush(batcher, get_time_ms(), &packet) != PAYLOAD_OK) {
+        return;
+    }
+    
+    uint16_t tx_id;
+    radio_error_t tx_result = radio_send_packet_async(&packet, &tx_id);
+    if (tx_result == RADIO_OK) {
+        printf("Batch of %u sample(s) queued in %u bytes (tx %u)\n",
+               (unsigned)sample_count, (unsigned)packet.payload_size, (unsigned)tx_id);
+    } else {
+        printf("✗ Radio transmission failed: %s\n", 
+               radio_get_error_string(tx_result));
+    }
+}
+
 int main(void) {
     printf("Hiring Firmware Skeleton C Project\n");
     printf("===================================\n");
@@ -33,15 +142,15 @@ int main(void) {
     printf("1. Initialize DS18B20 temperature sensor\n");
     printf("2. Initialize radio module with network configuration\n");
     printf("3. Read temperature data from sensor\n");
-    printf("4. Package data into radio packet with JSON payload\n");
+    printf("4. Package data into radio packet with binary payload\n");
     printf("5. Transmit packet with auto-retry and acknowledgment\n");
     printf("6. Enter low-power sleep mode between readings\n\n");
     
     printf("Ready for temperature monitoring and wireless data transmission!\n");
     
-    // Initialize temperature sensor
-    ds18b20_handle_t temp_sensor;
-    ds18b20_temperature_t temp_data;
+    // Initialize temperature sensors
+    ds18b20_handle_t temp_sensors[ACQUISITION_MAX_SENSORS];
+    acquisition_sweep_t sweep;
     
     // Initialize radio
     radio_config_t radio_config = {
@@ -55,46 +164,123 @@ int main(void) {
         .auto_ack = true,
         .auto_retry = true,
         .max_retries = 3,
+        .arq_window = 4,
+        .csma_max_backoffs = 4,
+        .csma_max_exponent = 5,
         .tx_timeout_ms = 5000
     };
     
     if (ds18b20_init(GPIO_PIN_1WIRE) == DS18B20_OK) {
         printf("✓ DS18B20 sensor initialized\n");
         
+        uint8_t sensor_count = 0;
+        if (ds18b20_scan_devices(temp_sensors, ACQUISITION_MAX_SENSORS, &sensor_count) != DS18B20_OK ||
+            sensor_count == 0) {
+            printf("✗ No DS18B20 sensor found on the 1-Wire bus\n");
+            return EXIT_FAILURE;
+        }
+        printf("✓ Found %u DS18B20 sensor(s)\n", (unsigned)sensor_count);
+        
         if (radio_init(&radio_config) == RADIO_OK) {
             printf("✓ Radio module initialized\n");
+            radio_set_event_callback(on_radio_event, NULL);
+            radio_set_rx_callback(on_radio_packet, NULL);
+            radio_set_tx_callback(on_radio_transmit, NULL);
+            
+            acquisition_t acquisition;
+            if (acquisition_init(&acquisition, temp_sensors, sensor_count, ACQUISITION_MODE) != DS18B20_OK) {
+                printf("✗ Failed to start temperature acquisition\n");
+                return EXIT_FAILURE;
+            }
+            
+            // Send a batch once it fills a packet; the security mode's
+            // frame counter and MIC come out of the payload space
+            batcher_t batcher;
+            batcher_config_t batch_config = {
+                .max_samples = payload_max_samples(radio_get_max_payload_size()),
+                .max_age_ms = BATCH_MAX_AGE_MS
+            };
+            batcher_init(&batcher, &batch_config);
+            
+            adr_t adr;
+            adr_config_t adr_config = {
+                .target_margin_db = ADR_TARGET_MARGIN_DB,
+                .hysteresis_db = ADR_HYSTERESIS_DB,
+                .loss_backoff_percent = ADR_LOSS_BACKOFF_PERCENT,
+                .window = ADR_WINDOW_CYCLES
+            };
+            adr_init(&adr, &adr_config);
+            
+            scheduler_t scheduler;
+            scheduler_init(&scheduler, REPORT_PERIOD_MS);
             
             // Main application loop
             while (1) {
-                // Read temperature
-                if (ds18b20_read_temperature_blocking(&temp_sensor, &temp_data) == DS18B20_OK) {
-                    printf("Temperature: %.2f°C\n", temp_data.temperature_c);
-                    
-                    // Prepare radio packet
-                    radio_packet_t packet = {0};
-                    packet.priority = RADIO_PRIORITY_NORMAL;
-                    packet.require_ack = true;
-                    
-                    // Simple JSON-like payload
-                    snprintf((char*)packet.payload, RADIO_MAX_PAYLOAD_SIZE,
-                             "{\"temp\":%.2f,\"unit\":\"C\",\"sensor\":\"DS18B20\"}",
-                             temp_data.temperature_c);
-                    packet.payload_size = strlen((char*)packet.payload);
-                    
-                    // Send temperature data
-                    radio_error_t tx_result = radio_send_packet(&packet);
-                    if (tx_result == RADIO_OK) {
-                        printf("✓ Temperature data transmitted\n");
-                    } else {
-                        printf("✗ Radio transmission failed: %s\n", 
-                               radio_get_error_string(tx_result));
+                // Read all sensors; in pipelined mode the next bus-wide
+                // conversion is already running while the batch is
+                // transmitted below.
+                if (acquisition_collect(&acquisition, &sweep) == DS18B20_OK) {
+                    for (uint8_t i = 0; i < sweep.count; i++) {
+                        if (!(sweep.valid_mask & (1u << i))) {
+                            continue;
+                        }
+                        
+                        char temp_text[8];
+                        format_centi_celsius(temp_text, sizeof(temp_text), sweep.centi_celsius[i]);
+                        printf("Sensor %u temperature: %s°C\n", (unsigned)i, temp_text);
+                        
+                        // Readings outside the sensor's alarm window are
+                        // delivered immediately rather than with the batch
+                        const ds18b20_handle_t *sensor = &temp_sensors[i];
+                        bool alarm = sweep.centi_celsius[i] > (int8_t)sensor->th_register * 100 ||
+                                     sweep.centi_celsius[i] < (int8_t)sensor->tl_register * 100;
+                        
+                        if (batcher_add(&batcher, i, sweep.raw[i], sweep.timestamp_ms, alarm) ==
+                            PAYLOAD_ERROR_BUFFER_TOO_SMALL) {
+                            send_batch(&batcher);
+                            batcher_add(&batcher, i, sweep.raw[i], sweep.timestamp_ms, alarm);
+                        }
+                    }
+                }
+                
+                if (batcher_should_flush(&batcher, get_time_ms())) {
+                    // While the 868 MHz duty-cycle budget is spent, a routine
+                    // batch keeps filling instead of queueing behind it; it
+                    // goes out once the budget allows or the batch is full
+                    uint32_t budget_wait_ms = 0;
+                    radio_get_duty_cycle_wait((uint8_t)payload_encoded_size(batcher.count), &budget_wait_ms);
+                    if (batcher.priority_pending || budget_wait_ms == 0) {
+                        send_batch(&batcher);
                     }
                 }
                 
-                // Try to keep to a once-per-second reporting cadence.
+                // Sleep until the next absolute deadline so that the time
+                // spent above does not stretch the reporting period.
                 radio_set_power_state(RADIO_POWER_SLEEP);
-                delay_ms(1000);
+                scheduler_wait_next(&scheduler);
                 radio_set_power_state(RADIO_POWER_IDLE);
+                radio_process();
+                
+                // Received packets are handed over here, a bounded number
+                // per cycle, rather than from the receive interrupt
+                uint8_t rx_dispatched = 0;
+                radio_dispatch_rx_events(RX_DISPATCH_BUDGET, &rx_dispatched);
+                
+                // Trade surplus link margin for airtime and energy, and
+                // back off again when the link degrades
+                bool radio_changed = false;
+                if (adr_update(&adr, &radio_config, &radio_changed) == RADIO_OK && radio_changed) {
+                    static const unsigned rate_kbps[] = { 1, 10, 50, 100, 250 };
+                    printf("Radio link adapted: %u kbps at %d dBm\n",
+                           rate_kbps[radio_config.data_rate],
+                           (int)radio_get_tx_power_dbm(radio_config.tx_power));
+                }
+                
+                printf("Cycle %u: work %u ms, jitter %d ms, missed deadlines %u\n",
+                       (unsigned)scheduler.stats.cycles,
+                       (unsigned)scheduler.stats.last_work_ms,
+                       (int)scheduler.stats.last_jitter_ms,
+                       (unsigned)scheduler.stats.missed_deadlines);
             }
         }
     }
@@ -0,0 +1,139 @@
+/**
+ * @file payload_codec.c
+ * @brief Binary sensor payload codec implementation
+ */
+
+#include "payload_codec.h"
+
+/**
+ * @brief Store a 16-bit value little-endian
+ * @param buffer Output position
+ * @param value Value to store
+ */
+static void put_u16(uint8_t *buffer, uint16_t value) {
+    buffer[0] = (uint8_t)(value & 0xFF);
+    buffer[1] = (uint8_t)(value >> 8);
+}
+
+/**
+ * @brief Load a little-endian 16-bit value
+ * @param buffer Input position
+ * @return uint16_t Loaded value
+ */
+static uint16_t get_u16(const uint8_t *buffer) {
+    return (uint16_t)(buffer[0] | (buffer[1] << 8));
+}
+
+size_t payload_encoded_size(uint8_t sample_count) {
+    return PAYLOAD_HEADER_SIZE + (size_t)sample_count * PAYLOAD_SAMPLE_SIZE;
+}
+
+uint8_t payload_max_samples(size_t payload_size) {
+    if (payload_size < PAYLOAD_HEADER_SIZE) {
+        return 0;
+    }
+
+    size_t samples = (payload_size - PAYLOAD_HEADER_SIZE) / PAYLOAD_SAMPLE_SIZE;
+    return samples > PAYLOAD_MAX_SAMPLES ? PAYLOAD_MAX_SAMPLES : (uint8_t)samples;
+}
+
+payload_error_t payload_encode(const payload_frame_t *frame,
+                               uint8_t *buffer,
+                               size_t buffer_size,
+                               size_t *encoded_size) {
+    if (frame == NULL || buffer == NULL || encoded_size == NULL) {
+        return PAYLOAD_ERROR_INVALID_PARAM;
+    }
+
+    if (frame->sample_count == 0 || frame->sample_count > PAYLOAD_MAX_SAMPLES) {
+        return PAYLOAD_ERROR_INVALID_PARAM;
+    }
+
+    size_t size = payload_encoded_size(frame->sample_count);
+    if (size > buffer_size) {
+        return PAYLOAD_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    buffer[0] = PAYLOAD_VERSION;
+    buffer[1] = frame->sample_count;
+    put_u16(&buffer[2], frame->sequence);
+
+    uint8_t *out = &buffer[PAYLOAD_HEADER_SIZE];
+    for (uint8_t i = 0; i < frame->sample_count; i++) {
+        const payload_sample_t *sample = &frame->samples[i];
+        out[0] = sample->device_id;
+        put_u16(&out[1], (uint16_t)sample->raw);
+        put_u16(&out[3], sample->age_ms);
+        out += PAYLOAD_SAMPLE_SIZE;
+    }
+
+    *encoded_size = size;
+    return PAYLOAD_OK;
+}
+
+payload_error_t payload_decode(const uint8_t *buffer,
+                               size_t size,
+                               payload_frame_t *frame) {
+    if (buffer == NULL || frame == NULL) {
+        return PAYLOAD_ERROR_INVALID_PARAM;
+    }
+
+    if (size < PAYLOAD_HEADER_SIZE) {
+        return PAYLOAD_ERROR_MALFORMED;
+    }
+
+    if (buffer[0] != PAYLOAD_VERSION) {
+        return PAYLOAD_ERROR_VERSION;
+    }
+
+    uint8_t sample_count = buffer[1];
+    if (sample_count == 0 || sample_count > PAYLOAD_MAX_SAMPLES ||
+        size != payload_encoded_size(sample_count)) {
+        return PAYLOAD_ERROR_MALFORMED;
+    }
+
+    frame->sequence = get_u16(&buffer[2]);
+    frame->sample_count = sample_count;
+
+    const uint8_t *in = &buffer[PAYLOAD_HEADER_SIZE];
+    for (uint8_t i = 0; i < sample_count; i++) {
+        payload_sample_t *sample = &frame->samples[i];
+        sample->device_id = in[0];
+        sample->raw = (int16_t)get_u16(&in[1]);
+        sample->age_ms = get_u16(&in[3]);
+        in += PAYLOAD_SAMPLE_SIZE;
+    }
+
+    return PAYLOAD_OK;
+}
+
+payload_error_t payload_add_age(uint8_t *buffer, size_t size, uint32_t elapsed_ms) {
+    payload_frame_t frame;
+    payload_error_t result = payload_decode(buffer, size, &frame);
+    if (result != PAYLOAD_OK) {
+        return result;
+    }
+
+    uint8_t *out = &buffer[PAYLOAD_HEADER_SIZE];
+    for (uint8_t i = 0; i < frame.sample_count; i++) {
+        uint32_t age_ms = frame.samples[i].age_ms + elapsed_ms;
+        if (age_ms < elapsed_ms || age_ms > PAYLOAD_MAX_AGE_MS) {
+            age_ms = PAYLOAD_MAX_AGE_MS;
+        }
+        put_u16(&out[3], (uint16_t)age_ms);
+        out += PAYLOAD_SAMPLE_SIZE;
+    }
+
+    return PAYLOAD_OK;
+}
+
+const char* payload_get_error_string(payload_error_t error) {
+    switch (error) {
+        case PAYLOAD_OK: return "Success";
+        case PAYLOAD_ERROR_INVALID_PARAM: return "Invalid parameter";
+        case PAYLOAD_ERROR_BUFFER_TOO_SMALL: return "Buffer too small";
+        case PAYLOAD_ERROR_VERSION: return "Unsupported frame version";
+        case PAYLOAD_ERROR_MALFORMED: return "Malformed frame";
+        default: return "Unknown error";
+    }
+}
@@ -0,0 +1,171 @@
+/**
+ * @file payload_codec.h
+ * @brief Binary sensor payload codec
+ *
+ * Compact, versioned frame format for temperature reports, shared by the
+ * node (encoder) and the gateway (decoder). All multi-byte fields are
+ * little-endian.
+ *
+ * Frame layout (version 1):
+ *
+ *     offset  size  field
+ *     0       1     version (PAYLOAD_VERSION)
+ *     1       1     sample count N
+ *     2       2     sequence number of the first sample
+ *     4       5*N   samples
+ *
+ * Sample layout:
+ *
+ *     offset  size  field
+ *     0       1     device id (sensor slot on the node)
+ *     1       2     raw temperature, int16, 1/16 °C per LSB
+ *     3       2     age in milliseconds when the frame went on air, saturating
+ *
+ * Sample i carries sequence number (first + i), modulo 2^16. The gateway
+ * recovers each sample's capture time as (frame receive time - age).
+ */
+
+#ifndef PAYLOAD_CODEC_H
+#define PAYLOAD_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "radio_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup Payload_Constants Payload Constants
+ * @{
+ */
+
+/** Current frame format version */
+#define PAYLOAD_VERSION             1
+
+/** Frame header size (bytes) */
+#define PAYLOAD_HEADER_SIZE         4
+
+/** Encoded size of one sample (bytes) */
+#define PAYLOAD_SAMPLE_SIZE         5
+
+/** Maximum number of samples in one radio frame */
+#define PAYLOAD_MAX_SAMPLES         ((RADIO_MAX_PAYLOAD_SIZE - PAYLOAD_HEADER_SIZE) / PAYLOAD_SAMPLE_SIZE)
+
+/** Largest representable sample age; older samples saturate to this */
+#define PAYLOAD_MAX_AGE_MS          UINT16_MAX
+
+/** @} */
+
+/** @defgroup Payload_Types Payload Type Definitions
+ * @{
+ */
+
+/**
+ * @brief Payload codec error codes
+ */
+typedef enum {
+    PAYLOAD_OK = 0,                   /**< Operation successful */
+    PAYLOAD_ERROR_INVALID_PARAM = -1, /**< Invalid parameter */
+    PAYLOAD_ERROR_BUFFER_TOO_SMALL = -2, /**< Output buffer too small */
+    PAYLOAD_ERROR_VERSION = -3,       /**< Unsupported frame version */
+    PAYLOAD_ERROR_MALFORMED = -4      /**< Frame length does not match header */
+} payload_error_t;
+
+/**
+ * @brief One temperature sample
+ */
+typedef struct {
+    uint8_t device_id;                /**< Sensor slot on the reporting node */
+    int16_t raw;                      /**< Raw temperature (1/16 °C per LSB) */
+    uint16_t age_ms;                  /**< Age in milliseconds (see payload_add_age()) */
+} payload_sample_t;
+
+/**
+ * @brief Decoded frame contents
+ */
+typedef struct {
+    uint16_t sequence;                /**< Sequence number of the first sample */
+    uint8_t sample_count;             /**< Number of valid entries in samples */
+    payload_sample_t samples[PAYLOAD_MAX_SAMPLES]; /**< Samples */
+} payload_frame_t;
+
+/** @} */
+
+/** @defgroup Payload_Functions Payload API Functions
+ * @{
+ */
+
+/**
+ * @brief Get the encoded size of a frame
+ *
+ * @param[in] sample_count Number of samples in the frame
+ * @return size_t Encoded size in bytes
+ */
+size_t payload_encoded_size(uint8_t sample_count);
+
+/**
+ * @brief Get the number of samples that fit in a payload
+ *
+ * @param[in] payload_size Payload space available (bytes)
+ * @return uint8_t Sample count, at most PAYLOAD_MAX_SAMPLES
+ */
+uint8_t payload_max_samples(size_t payload_size);
+
+/**
+ * @brief Encode a frame
+ *
+ * @param[in] frame Frame to encode (1 to PAYLOAD_MAX_SAMPLES samples)
+ * @param[out] buffer Output buffer
+ * @param[in] buffer_size Size of the output buffer
+ * @param[out] encoded_size Pointer to store the number of bytes written
+ * @return payload_error_t Error code
+ */
+payload_error_t payload_encode(const payload_frame_t *frame,
+                               uint8_t *buffer,
+                               size_t buffer_size,
+                               size_t *encoded_size);
+
+/**
+ * @brief Decode a frame
+ *
+ * Validates the version and that the length matches the sample count.
+ *
+ * @param[in] buffer Encoded frame
+ * @param[in] size Encoded frame length
+ * @param[out] frame Pointer to store the decoded frame
+ * @return payload_error_t Error code
+ */
+payload_error_t payload_decode(const uint8_t *buffer,
+                               size_t size,
+                               payload_frame_t *frame);
+
+/**
+ * @brief Age every sample of an encoded frame in place
+ *
+ * Ages are encoded as of encode time; this brings them up to the time the
+ * frame goes on air, however long it waited in the transmit queue.
+ *
+ * @param[in,out] buffer Encoded frame
+ * @param[in] size Encoded frame length
+ * @param[in] elapsed_ms Time since the ages were taken; ages saturate at
+ *            PAYLOAD_MAX_AGE_MS
+ * @return payload_error_t Error code
+ */
+payload_error_t payload_add_age(uint8_t *buffer, size_t size, uint32_t elapsed_ms);
+
+/**
+ * @brief Get error string description
+ *
+ * @param[in] error Error code
+ * @return const char* Error description string
+ */
+const char* payload_get_error_string(payload_error_t error);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PAYLOAD_CODEC_H */
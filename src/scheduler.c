@@ -0,0 +1,47 @@
+/**
+ * @file scheduler.c
+ * @brief Fixed-rate reporting scheduler implementation
+ */
+
+#include "scheduler.h"
+#include "microcontroller.h"
+
+void scheduler_init(scheduler_t *scheduler, uint32_t period_ms) {
+    uint32_t now = get_time_ms();
+
+    scheduler->period_ms = period_ms;
+    scheduler->next_deadline_ms = now;
+    scheduler->cycle_start_ms = now;
+    scheduler->stats = (scheduler_stats_t){0};
+    scheduler->stats.cycles = 1;
+}
+
+void scheduler_wait_next(scheduler_t *scheduler) {
+    scheduler_stats_t *stats = &scheduler->stats;
+    uint32_t now = get_time_ms();
+    uint32_t work_ms = now - scheduler->cycle_start_ms;
+
+    stats->last_work_ms = work_ms;
+    if (work_ms > stats->max_work_ms) {
+        stats->max_work_ms = work_ms;
+    }
+
+    // Next slot on the grid; if the work ran up to or past it, skip it and
+    // every later deadline already passed, to the first one still ahead
+    scheduler->next_deadline_ms += scheduler->period_ms;
+    int32_t late = time_diff_ms(now, scheduler->next_deadline_ms);
+    if (late >= 0) {
+        uint32_t skipped = (uint32_t)late / scheduler->period_ms + 1;
+        scheduler->next_deadline_ms += skipped * scheduler->period_ms;
+        stats->missed_deadlines += skipped;
+    }
+
+    delay_until_ms(scheduler->next_deadline_ms);
+
+    scheduler->cycle_start_ms = get_time_ms();
+    stats->last_jitter_ms = time_diff_ms(scheduler->cycle_start_ms, scheduler->next_deadline_ms);
+    if (stats->last_jitter_ms > stats->max_jitter_ms) {
+        stats->max_jitter_ms = stats->last_jitter_ms;
+    }
+    stats->cycles++;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file scheduler.h
+ * @brief Fixed-rate reporting scheduler
+ *
+ * Runs the application cycle on an absolute-deadline grid derived from the
+ * monotonic clock. Each wait sleeps until the next deadline rather than for
+ * a fixed delay, so the time spent doing work is absorbed into the period
+ * instead of being added to it, and the cadence does not drift.
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Scheduler timing statistics
+ */
+typedef struct {
+    uint32_t cycles;                  /**< Cycles started */
+    uint32_t missed_deadlines;        /**< Deadlines skipped because work ran up to or past them */
+    int32_t last_jitter_ms;           /**< Wake-up time minus deadline, last cycle */
+    int32_t max_jitter_ms;            /**< Largest wake-up lateness observed */
+    uint32_t last_work_ms;            /**< Busy time of the last completed cycle */
+    uint32_t max_work_ms;             /**< Longest busy time observed */
+} scheduler_stats_t;
+
+/**
+ * @brief Scheduler state
+ */
+typedef struct {
+    uint32_t period_ms;               /**< Cycle period */
+    uint32_t next_deadline_ms;        /**< Absolute deadline of the next cycle */
+    uint32_t cycle_start_ms;          /**< Wake-up time of the current cycle */
+    scheduler_stats_t stats;          /**< Timing statistics */
+} scheduler_t;
+
+/**
+ * @brief Initialize a scheduler
+ *
+ * Starts the first cycle immediately; later cycles begin at whole
+ * multiples of the period after this call.
+ *
+ * @param[out] scheduler Scheduler to initialize
+ * @param[in] period_ms Cycle period in milliseconds (must be non-zero)
+ */
+void scheduler_init(scheduler_t *scheduler, uint32_t period_ms);
+
+/**
+ * @brief Sleep until the next cycle deadline
+ *
+ * Closes the current cycle (recording how long its work took) and sleeps
+ * until the next absolute deadline. If the work ran up to or past that
+ * deadline, by however little, it and every later deadline already
+ * passed are counted as missed and skipped: the next cycle starts at the
+ * first deadline still ahead, so the schedule stays aligned to the
+ * original grid instead of bursting to catch up.
+ *
+ * @param[in,out] scheduler Scheduler state
+ */
+void scheduler_wait_next(scheduler_t *scheduler);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHEDULER_H */